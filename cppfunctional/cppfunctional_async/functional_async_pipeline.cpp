@@ -0,0 +1,141 @@
+//
+// Created by Davide Russo on 19/10/26.
+//
+
+#ifndef FUNCTIONAL_ASYNC_PIPELINE_CPP_
+#define FUNCTIONAL_ASYNC_PIPELINE_CPP_
+
+#include "functional_async_pipeline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace functional {
+
+    template<typename Src, typename T>
+    functional_async_pipeline<Src, T>::functional_async_pipeline(const functional_vector<Src> &source,
+                                                                 unsigned long concurrency, bool ordered) :
+            functional_async_pipeline(std::make_shared<const functional_vector<Src>>(source),
+                                      [](const Src &x) { return std::optional<T>(x); },
+                                      concurrency, ordered) {}
+
+    template<typename Src, typename T>
+    functional_async_pipeline<Src, T>::functional_async_pipeline(std::shared_ptr<const functional_vector<Src>> source,
+                                                                 stage_t stage, unsigned long concurrency,
+                                                                 bool ordered) :
+            m_source(std::move(source)),
+            m_stage(std::move(stage)),
+            m_concurrency(concurrency),
+            m_ordered(ordered) {}
+
+    template<typename Src, typename T>
+    template<typename Func>
+    functional_async_pipeline<Src, typename std::result_of<Func(const T &)>::type>
+    functional_async_pipeline<Src, T>::map(Func &&mapper) const {
+        using O = typename std::result_of<Func(const T &)>::type;
+        auto stage = [previous = m_stage, mapper = std::decay_t<Func>(std::forward<Func>(mapper))]
+                (const Src &x) -> std::optional<O> {
+            auto t = previous(x);
+            if (!t)
+                return std::nullopt;
+            return mapper(*t);
+        };
+        return functional_async_pipeline<Src, O>(m_source, std::move(stage), m_concurrency, m_ordered);
+    }
+
+    template<typename Src, typename T>
+    template<typename Func>
+    functional_async_pipeline<Src, T> functional_async_pipeline<Src, T>::filter(Func &&test) const {
+        auto stage = [previous = m_stage, test = std::decay_t<Func>(std::forward<Func>(test))]
+                (const Src &x) -> std::optional<T> {
+            auto t = previous(x);
+            if (t and !test(*t))
+                return std::nullopt;
+            return t;
+        };
+        return functional_async_pipeline(m_source, std::move(stage), m_concurrency, m_ordered);
+    }
+
+    template<typename Src, typename T>
+    functional_async_pipeline<Src, T> functional_async_pipeline<Src, T>::concurrency(unsigned long n) const noexcept {
+        return functional_async_pipeline(m_source, m_stage, n, m_ordered);
+    }
+
+    template<typename Src, typename T>
+    functional_async_pipeline<Src, T> functional_async_pipeline<Src, T>::ordered(bool ordered) const noexcept {
+        return functional_async_pipeline(m_source, m_stage, m_concurrency, ordered);
+    }
+
+    template<typename Src, typename T>
+    unsigned long functional_async_pipeline<Src, T>::m_workers() const noexcept {
+        unsigned long n = m_concurrency != 0 ? m_concurrency : std::thread::hardware_concurrency();
+        return std::max(1ul, std::min<unsigned long>(n, m_source->size()));
+    }
+
+    template<typename Src, typename T>
+    functional_vector<T> functional_async_pipeline<Src, T>::collect() const {
+
+        std::size_t size = m_source->size();
+        functional_vector<T> fl;
+
+        if (size == 0)
+            return fl;
+
+        std::vector<std::optional<T>> slots(m_ordered ? size : 0);
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex mutex;
+
+        auto fail = [&](std::exception_ptr e) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failed.exchange(true))
+                error = std::move(e);
+        };
+
+        auto worker = [&]() {
+            for (std::size_t i; !failed and (i = next++) < size;) {
+                try {
+                    auto t = m_stage(m_source->std::vector<Src>::operator[](i));
+                    if (!t)
+                        continue;
+                    if (m_ordered)
+                        slots[i] = std::move(t);
+                    else {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        fl.add(std::move(*t));
+                    }
+                } catch (...) {
+                    fail(std::current_exception());
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        try {
+            for (unsigned long i = 1, workers = m_workers(); i < workers; i++) // the caller is a worker as well
+                threads.emplace_back(worker);
+        } catch (...) {
+            fail(std::current_exception());
+        }
+        worker();
+        for (std::thread &thread : threads)
+            thread.join();
+
+        if (error)
+            std::rethrow_exception(error);
+
+        for (std::optional<T> &t : slots)
+            if (t)
+                fl.add(std::move(*t));
+
+        return fl;
+    }
+
+}
+
+#endif
@@ -0,0 +1,62 @@
+//
+// Created by Davide Russo on 19/10/26.
+//
+
+#ifndef FUNCTIONAL_ASYNC_PIPELINE_HPP_
+#define FUNCTIONAL_ASYNC_PIPELINE_HPP_
+
+#include "../cppfunctional_vector/functional_vector.hpp"
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+namespace functional {
+
+    // Lazy pipeline over a snapshot of a functional_vector. Stages are fused per element: every element flows
+    // through all of the map/filter stages on the same worker, so at most 'concurrency' elements are in flight
+    // across the whole pipeline and a slow stage cannot pile up work in front of the following ones.
+    template<typename Src, typename T>
+    class functional_async_pipeline final {
+
+    public:
+
+        // 0 means std::thread::hardware_concurrency()
+        functional_async_pipeline(const functional_vector<Src> &, unsigned long concurrency = 0, bool ordered = true);
+
+        template<typename Func>
+        inline functional_async_pipeline<Src, typename std::result_of<Func(const T &)>::type> map(Func &&) const;
+
+        template<typename Func>
+        inline functional_async_pipeline filter(Func &&) const;
+
+        inline functional_async_pipeline concurrency(unsigned long) const noexcept;
+
+        inline functional_async_pipeline ordered(bool = true) const noexcept;
+
+        functional_vector<T> collect() const; // rethrows the first exception raised by a stage
+
+    private:
+
+        using stage_t = std::function<std::optional<T>(const Src &)>;
+
+        functional_async_pipeline(std::shared_ptr<const functional_vector<Src>>, stage_t, unsigned long, bool);
+
+        inline unsigned long m_workers() const noexcept;
+
+        std::shared_ptr<const functional_vector<Src>> m_source;
+        stage_t m_stage;
+        unsigned long m_concurrency;
+        bool m_ordered;
+
+        template<typename S, typename O> friend
+        class functional_async_pipeline;
+
+    };
+
+}
+
+
+#include "functional_async_pipeline.cpp"
+
+#endif /* FUNCTIONAL_ASYNC_PIPELINE_HPP_ */
@@ -9,6 +9,7 @@
 
 #include "functional_vector.hpp"
 #include "../cppfunctional_exceptions/functional_exceptions.hpp"
+#include "../cppfunctional_async/functional_async_pipeline.hpp"
 
 #include <algorithm>
 
@@ -179,6 +180,11 @@ namespace functional {
             f(x);
     }
 
+    template<typename T>
+    functional_async_pipeline<T, T> functional_vector<T>::async(unsigned long concurrency, bool ordered) const {
+        return functional_async_pipeline<T, T>(*this, concurrency, ordered);
+    }
+
     template<typename T>
     template<typename Func>
     functional_vector<T> functional_vector<T>::max_by(Func &&key) const {
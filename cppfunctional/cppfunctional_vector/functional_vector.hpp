@@ -14,6 +14,9 @@
 
 namespace functional {
 
+    template<typename Src, typename T>
+    class functional_async_pipeline;
+
     template<typename T>
     class functional_vector final : public std::vector<T> {
 
@@ -43,6 +46,8 @@ namespace functional {
         template<typename Func>
         inline void for_each(Func &&) const noexcept;
 
+        inline functional_async_pipeline<T, T> async(unsigned long concurrency = 0, bool ordered = true) const;
+
         template<typename Func>
         inline functional_vector max_by(Func &&) const;
 
@@ -9,5 +9,6 @@ namespace functional {}
 
 #include <cppfunctional_vector/functional_vector.hpp>
 #include <cppfunctional_exceptions/functional_exceptions.hpp>
+#include <cppfunctional_async/functional_async_pipeline.hpp>
 
 #endif //FUNCTIONAL_LIST_FUNCTIONAL_H
@@ -34,3 +34,25 @@ TEST_F(FunctionalTest, test_reduce) {
     auto x = p_func_list->reduce(0, [](auto acc, auto x) { return acc + x; });
     EXPECT_EQ(x, 33);
 }
+
+TEST_F(FunctionalTest, test_async_ordered) {
+    auto fl = p_func_list->async(3)
+            .map([](auto x) { return x * 2; })
+            .filter([](auto x) { return x > 0; })
+            .collect();
+    EXPECT_EQ(fl, (functional_vector<int>{2, 4, 20, 30, 30}));
+}
+
+TEST_F(FunctionalTest, test_async_unordered) {
+    auto fl = p_func_list->async(4, false).map([](auto x) { return x + 1; }).collect();
+    EXPECT_EQ(fl.sort(), p_func_list->map([](auto x) { return x + 1; }).sort());
+}
+
+TEST_F(FunctionalTest, test_async_exception) {
+    auto pipeline = p_func_list->async().map([](auto x) {
+        if (x < 0)
+            throw std::runtime_error("negative");
+        return x;
+    });
+    EXPECT_THROW(pipeline.collect(), std::runtime_error);
+}